@@ -8,6 +8,9 @@
 
 #import <Foundation/Foundation.h>
 
+/** 需要2.10.0版本的二进制库，二进制库发布之前这些接口不可用 */
+#define TTT_API_UNAVAILABLE __attribute__((unavailable("requires the TTTRtcEngineKit 2.10.0 binary")))
+
 /** Error codes */
 typedef NS_ENUM(NSUInteger, TTTRtcErrorCode) {
     /** 0: 没有错误， 接口调用成功 */
@@ -89,6 +92,14 @@ typedef NS_ENUM(NSUInteger, TTTRtcLogFilter) {
     TTTRtc_LogFilter_Critical = 0x0008
 };
 
+/** 日志文件格式 */
+typedef NS_ENUM(NSUInteger, TTTRtcLogFormat) {
+    /** UTF-8文本，默认值 */
+    TTTRtc_LogFormat_Text   = 0,
+    /** 二进制，只记录格式id和参数，在后台线程写入，需要([TTTRtcEngineKit decodeLogFile:toFile:])转换为文本 */
+    TTTRtc_LogFormat_Binary = 1,
+};
+
 /** 频道模式 */
 typedef NS_ENUM(NSUInteger, TTTRtcChannelProfile) {
     /** 通信模式(默认值)，一对一自由通话，单用户在房间内不上行视频 */
@@ -288,6 +299,60 @@ typedef NS_ENUM(NSUInteger, TTTVideoType) {
     TTTVideoTypeCamera     = 4
 };
 
+/** 低延迟HLS输出状态 */
+typedef NS_ENUM(NSUInteger, TTTRtcHlsPublishStatus) {
+    /** 开始输出 */
+    TTTRtc_HlsPublishStatus_Started    = 0,
+    /** 写入分片失败 */
+    TTTRtc_HlsPublishStatus_WriteError = 1,
+    /** 停止输出 */
+    TTTRtc_HlsPublishStatus_Stopped    = 2,
+};
+
+/** 视频帧处理阶段 */
+typedef NS_ENUM(NSUInteger, TTTRtcFrameStage) {
+    /** 采集 -> 前处理 */
+    TTTRtc_FrameStage_Preprocess = 0,
+    /** 前处理 -> 编码完成 */
+    TTTRtc_FrameStage_Encode     = 1,
+    /** 编码完成 -> 打包 */
+    TTTRtc_FrameStage_Packetize  = 2,
+    /** 打包 -> 发送 */
+    TTTRtc_FrameStage_Send       = 3,
+    /** 发送 -> 接收(网络传输)，发送端时间按时钟偏差换算到接收端时钟 */
+    TTTRtc_FrameStage_Network    = 4,
+    /** 接收 -> 解码完成(含缓冲) */
+    TTTRtc_FrameStage_Decode     = 5,
+    /** 解码完成 -> 渲染 */
+    TTTRtc_FrameStage_Render     = 6,
+    /** 采集 -> 渲染，发送端时间按时钟偏差换算到接收端时钟 */
+    TTTRtc_FrameStage_Total      = 7,
+};
+
+/** 直方图统计项 */
+typedef NS_ENUM(NSUInteger, TTTRtcHistogramMetric) {
+    /** 延迟(ms) */
+    TTTRtc_HistogramMetric_Delay      = 0,
+    /** rtt(ms) */
+    TTTRtc_HistogramMetric_Rtt        = 1,
+    /** 抖动(ms) */
+    TTTRtc_HistogramMetric_Jitter     = 2,
+    /** 视频渲染帧间隔(ms) */
+    TTTRtc_HistogramMetric_RenderGap  = 3,
+    /** 编码耗时(ms) */
+    TTTRtc_HistogramMetric_EncodeTime = 4,
+    /** 解码耗时(ms) */
+    TTTRtc_HistogramMetric_DecodeTime = 5,
+};
+
+/** 统计快照中的流类型 */
+typedef NS_ENUM(uint32_t, TTTRtcStreamKind) {
+    TTTRtc_StreamKind_LocalAudio  = 0,
+    TTTRtc_StreamKind_LocalVideo  = 1,
+    TTTRtc_StreamKind_RemoteAudio = 2,
+    TTTRtc_StreamKind_RemoteVideo = 3,
+};
+
 /** 连麦主播离开原因 */
 typedef NS_ENUM(NSUInteger, TTTRtcAnchorExitReason) {
     TTTRtc_AnchorExit_Unlink    = 0, // 其他主播结束与“我”连麦，正常离开
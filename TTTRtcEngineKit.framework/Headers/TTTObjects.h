@@ -43,6 +43,26 @@ typedef NSImageView TImageView;
 
 @end
 
+/** 本地视频分层统计信息 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcLocalVideoLayerStats : NSObject
+/** 空间层, 0为最低分辨率 */
+@property (assign, nonatomic) NSUInteger spatialLayer;
+/** 宽 */
+@property (assign, nonatomic) NSUInteger width;
+/** 高 */
+@property (assign, nonatomic) NSUInteger height;
+/** 编码的帧率(fps) */
+@property (assign, nonatomic) NSUInteger encodedFrameRate;
+/** 编码的码率(kbps) */
+@property (assign, nonatomic) NSUInteger encodedBitrate;
+/** 各时间层的码率(kbps), 下标为时间层 */
+@property (strong, nonatomic) NSArray<NSNumber *> *temporalLayerBitrates;
+/** 编码耗时(ms)，平均值 */
+@property (assign, nonatomic) NSUInteger encodeTime;
+
+@end
+
 /**
  *  本地视频统计信息
  */
@@ -67,6 +87,8 @@ typedef NSImageView TImageView;
 @property (assign, nonatomic) int bufferDuration;
 /** rtt */
 @property (assign, nonatomic) NSUInteger rtt;
+/** 分层统计信息，启用([TTTRtcEngineKit enableSimulcast:temporalLayers:])时有效 */
+@property (strong, nonatomic) NSArray<TTTRtcLocalVideoLayerStats *> *layerStats TTT_API_UNAVAILABLE;
 
 @end
 
@@ -91,6 +113,8 @@ typedef NSImageView TImageView;
 @interface TTTRtcRemoteVideoStats : NSObject
 /** 用户id */
 @property (assign, nonatomic) int64_t uid;
+/** 房间id，订阅其它房间([TTTRtcEngineKit subscribeOtherChannel:])的用户有效，本房间为0 */
+@property (assign, nonatomic) int64_t channelId TTT_API_UNAVAILABLE;
 /** 延迟(ms) */
 @property (assign, nonatomic) NSUInteger delay;
 /** 宽 */
@@ -111,6 +135,10 @@ typedef NSImageView TImageView;
 @property (assign, nonatomic) CGFloat loseRate;
 /** rtt */
 @property (assign, nonatomic) NSUInteger rtt;
+/** 当前接收的空间层 */
+@property (assign, nonatomic) NSUInteger spatialLayer TTT_API_UNAVAILABLE;
+/** 当前接收的时间层 */
+@property (assign, nonatomic) NSUInteger temporalLayer TTT_API_UNAVAILABLE;
 
 @end
 
@@ -118,6 +146,8 @@ typedef NSImageView TImageView;
 @interface TTTRtcRemoteAudioStats : NSObject
 /** 用户id */
 @property (assign, nonatomic) int64_t uid;
+/** 房间id，订阅其它房间([TTTRtcEngineKit subscribeOtherChannel:])的用户有效，本房间为0 */
+@property (assign, nonatomic) int64_t channelId TTT_API_UNAVAILABLE;
 /** 接收码率(kbps) */
 @property (assign, nonatomic) NSUInteger receivedBitrate;
 /** 丢包率 */
@@ -221,6 +251,16 @@ typedef NSImageView TImageView;
 @property (assign, nonatomic) int channels;
 /** 智感超清 默认是0， 开启设置1*/
 @property (assign, nonatomic) int encoderMode;
+/** cdn发送缓冲区上限(ms), 默认3000
+    超出时先丢弃非参考帧，再丢弃整个GOP，不丢弃音频，从下一个关键帧恢复发送
+ */
+@property (assign, nonatomic) int maxBufferDuration TTT_API_UNAVAILABLE;
+/** 发送缓冲区丢帧时是否请求关键帧并降低cdn视频码率, 默认NO */
+@property (assign, nonatomic) BOOL adaptOnCongestion TTT_API_UNAVAILABLE;
+/** 暂停推流([TTTRtcEngineKit pauseRtmpPublish])期间是否发送静音音频, 默认YES
+    暂停期间保持cdn连接和编码器，不发送静音音频时只发送保活数据
+ */
+@property (assign, nonatomic) BOOL sendSilenceOnPause TTT_API_UNAVAILABLE;
 
 @property (assign, nonatomic) NSInteger __deprecated bitrate;
 @end
@@ -268,6 +308,341 @@ typedef NSImageView TImageView;
 
 @end
 
+/** 单方向的网络损伤参数(网络模拟器) */
+TTT_API_UNAVAILABLE
+@interface TTTRtcNetworkImpairment : NSObject
+/** [0.0, 1.0] 随机丢包率 */
+@property (assign, nonatomic) float lossRate;
+/** 连续丢包的平均长度(包)，<=1 为随机丢包 */
+@property (assign, nonatomic) NSUInteger lossBurstLength;
+/** 额外的单向延迟(ms)，用于模拟RTT阶跃 */
+@property (assign, nonatomic) NSUInteger delay;
+/** 延迟抖动(ms) */
+@property (assign, nonatomic) NSUInteger jitter;
+/** [0.0, 1.0] 乱序概率 */
+@property (assign, nonatomic) float reorderRate;
+/** 带宽上限(kbps)，0 表示不限制 */
+@property (assign, nonatomic) NSUInteger bandwidth;
+/** 瓶颈队列长度(ms)，超出部分丢弃 */
+@property (assign, nonatomic) NSUInteger queueDuration;
+
+@end
+
+/** 断网重连统计信息 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcReconnectStats : NSObject
+/** YES: 通过会话恢复完成重连 NO: 重新加入房间 */
+@property (assign, nonatomic) BOOL resumed;
+/** 从网络恢复到重连成功的时间(ms) */
+@property (assign, nonatomic) NSUInteger reconnectElapsed;
+/** 断网时长(ms) */
+@property (assign, nonatomic) NSUInteger outageDuration;
+/** 重连后重新订阅的视频流数 */
+@property (assign, nonatomic) NSUInteger resubscribedStreams;
+
+@end
+
+/** 网络带宽探测配置 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcLastmileProbeConfig : NSObject
+/** 是否探测上行网络 */
+@property (assign, nonatomic) BOOL probeUplink;
+/** 是否探测下行网络 */
+@property (assign, nonatomic) BOOL probeDownlink;
+/** 期望的最高上行码率(kbps)，探测不会超过该码率 */
+@property (assign, nonatomic) NSUInteger expectedUplinkBitrate;
+/** 期望的最高下行码率(kbps)，探测不会超过该码率 */
+@property (assign, nonatomic) NSUInteger expectedDownlinkBitrate;
+/** 探测最长时间(ms)，默认5000 */
+@property (assign, nonatomic) NSUInteger maxDuration;
+
+@end
+
+/** 单向网络带宽探测结果 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcLastmileProbeOneWayResult : NSObject
+/** 估计的可用带宽(kbps) */
+@property (assign, nonatomic) NSUInteger availableBandwidth;
+/** 丢包率 */
+@property (assign, nonatomic) float lossRate;
+/** 抖动(ms) */
+@property (assign, nonatomic) NSUInteger jitter;
+
+@end
+
+/** 网络带宽探测结果 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcLastmileProbeResult : NSObject
+/** 上行探测结果 */
+@property (strong, nonatomic) TTTRtcLastmileProbeOneWayResult *uplinkReport;
+/** 下行探测结果 */
+@property (strong, nonatomic) TTTRtcLastmileProbeOneWayResult *downlinkReport;
+/** rtt中位数(ms) */
+@property (assign, nonatomic) NSUInteger rttMedian;
+/** rtt 95分位(ms) */
+@property (assign, nonatomic) NSUInteger rtt95;
+/** rtt最大值(ms) */
+@property (assign, nonatomic) NSUInteger rttMax;
+/** 推荐的视频编码属性，用于([TTTRtcEngineKit setVideoProfile:swapWidthAndHeight:]) */
+@property (assign, nonatomic) TTTRtcVideoProfile recommendedVideoProfile;
+/** 推荐的音频编码格式，用于([TTTRtcEngineKit setPreferAudioCodec:bitrate:channels:]) */
+@property (assign, nonatomic) TTTRtcAudioCodecType recommendedAudioCodec;
+/** 推荐的音频码率(kbps) */
+@property (assign, nonatomic) NSUInteger recommendedAudioBitrate;
+
+@end
+
+/** 订阅房间统计信息 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcChannelStats : NSObject
+/** 房间id，0表示本房间 */
+@property (assign, nonatomic) int64_t channelId;
+/** 接收字节数，累计值 */
+@property (assign, nonatomic) NSUInteger rxBytes;
+/** 音频接收码率 (kbps)，瞬时值 */
+@property (assign, nonatomic) NSUInteger rxAudioKBitrate;
+/** 视频接收码率 (kbps)，瞬时值 */
+@property (assign, nonatomic) NSUInteger rxVideoKBitrate;
+/** 接收的音视频流数 */
+@property (assign, nonatomic) NSUInteger streams;
+/** 正在解码的视频流数 */
+@property (assign, nonatomic) NSUInteger decodingStreams;
+
+@end
+
+/** cdn推流统计信息 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcRtmpStats : NSObject
+/** cdn推流地址 */
+@property (copy, nonatomic) NSString *rtmpUrl;
+/** 发送队列中的包数 */
+@property (assign, nonatomic) NSUInteger queueDepth;
+/** 发送队列中数据的时长(ms)，即发送缓冲区占用 */
+@property (assign, nonatomic) NSUInteger queueDuration;
+/** 发送的码率(kbps) */
+@property (assign, nonatomic) NSUInteger sentBitrate;
+/** 发送字节数，累计值 */
+@property (assign, nonatomic) NSUInteger txBytes;
+/** 因队列满丢弃的帧数，累计值 */
+@property (assign, nonatomic) NSUInteger droppedFrames;
+/** 丢弃的完整GOP数，累计值 */
+@property (assign, nonatomic) NSUInteger droppedGops;
+
+@end
+
+/** 混屏背景图缓存统计信息 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcImageCacheStats : NSObject
+/** 命中次数，累计值 */
+@property (assign, nonatomic) NSUInteger hits;
+/** 未命中次数，累计值 */
+@property (assign, nonatomic) NSUInteger misses;
+/** 缓存的图片数(按地址和画布尺寸) */
+@property (assign, nonatomic) NSUInteger count;
+/** 占用内存(Byte) */
+@property (assign, nonatomic) NSUInteger memoryUsage;
+
+@end
+
+/** 低延迟HLS(CMAF)输出配置 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcHlsConfiguration : NSObject
+/** 输出地址，本地目录(file://)或支持HTTP PUT的地址(http://, https://) */
+@property (copy, nonatomic) NSString *outputUrl;
+/** 分片时长(ms), 默认2000 */
+@property (assign, nonatomic) NSUInteger segmentDuration;
+/** 部分分片时长(ms), 默认333 */
+@property (assign, nonatomic) NSUInteger partDuration;
+/** 播放列表中保留的分片数, 默认6 */
+@property (assign, nonatomic) NSUInteger playlistLength;
+/** 对应的cdn推流地址，推多路流时使用该推流地址的混屏数据，推单路流可设置为nil */
+@property (copy, nonatomic) NSString *rtmpUrl;
+
+@end
+
+/** 本地录制配置 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcMediaRecordConfiguration : NSObject
+/** 录制文件的完整路径: xxx/.../xxx.mp4 */
+@property (copy, nonatomic) NSString *filePath;
+/** 录制的用户id，本地用户为0 */
+@property (assign, nonatomic) int64_t uid;
+/** 设备id(远端用户多流必选参数) */
+@property (copy, nonatomic) NSString *deviceId;
+/** 分片时长(ms), 默认2000。文件按分片写入，异常退出最多丢失最后一个分片 */
+@property (assign, nonatomic) NSUInteger fragmentDuration;
+/** 单个文件大小上限(Byte)，超出后切换新文件(xxx_1.mp4, xxx_2.mp4...), 0: 不限制 */
+@property (assign, nonatomic) NSUInteger maxFileSize;
+/** 单个文件时长上限(ms)，超出后切换新文件, 0: 不限制 */
+@property (assign, nonatomic) NSUInteger maxFileDuration;
+/** 混屏录制对应的cdn推流地址，推单路流可设置为nil，([TTTRtcEngineKit startVideoMixerRecording:handler:])使用 */
+@property (copy, nonatomic) NSString *rtmpUrl;
+
+@end
+
+/** 视频帧各阶段延迟统计 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcFrameLatencyStats : NSObject
+/** 用户id */
+@property (assign, nonatomic) int64_t uid;
+/** 设备id(远端用户多流必选参数) */
+@property (copy, nonatomic) NSString *deviceId;
+/** 处理阶段 */
+@property (assign, nonatomic) TTTRtcFrameStage stage;
+/** 统计的帧数 */
+@property (assign, nonatomic) NSUInteger count;
+/** 50分位延迟(ms) */
+@property (assign, nonatomic) double p50;
+/** 95分位延迟(ms) */
+@property (assign, nonatomic) double p95;
+/** 99分位延迟(ms) */
+@property (assign, nonatomic) double p99;
+/** 最大延迟(ms) */
+@property (assign, nonatomic) double max;
+
+@end
+
+/** 单路流统计快照，累计值不会清零 */
+typedef struct TTTRtcStreamStatsSnapshot {
+    /** 结构体大小，调用方设置为sizeof(TTTRtcStreamStatsSnapshot) */
+    uint32_t structSize;
+    /** 流类型 */
+    TTTRtcStreamKind kind;
+    /** 用户id，本地用户为0 */
+    int64_t uid;
+    /** 房间id，订阅其它房间([TTTRtcEngineKit subscribeOtherChannel:])的用户有效，本房间为0 */
+    int64_t channelId;
+    /** 设备id(远端用户多流)，UTF-8，以'\0'结尾，超出63字节截断 */
+    char deviceId[64];
+    /** 宽，音频为0 */
+    uint32_t width;
+    /** 高，音频为0 */
+    uint32_t height;
+    /** 码率(kbps)，发送或接收 */
+    uint32_t bitrate;
+    /** 帧率(fps)，音频为0 */
+    uint32_t frameRate;
+    /** 延迟(ms) */
+    uint32_t delay;
+    /** rtt(ms) */
+    uint32_t rtt;
+    /** 缓存时长(ms) */
+    uint32_t bufferDuration;
+    /** 丢包率 */
+    float lossRate;
+    /** 发送或接收字节数，累计值 */
+    uint64_t bytes;
+    /** 发送或接收帧数，累计值 */
+    uint64_t frames;
+    /** 丢掉的帧数，累计值 */
+    uint64_t lostFrames;
+} TTTRtcStreamStatsSnapshot;
+
+/** 通话统计快照 */
+typedef struct TTTRtcStatsSnapshot {
+    /** 结构体大小，调用方设置为sizeof(TTTRtcStatsSnapshot) */
+    uint32_t structSize;
+    /** 快照时间，单调时钟(ms) */
+    uint64_t timestamp;
+    /** 通话时长(s) */
+    uint32_t duration;
+    /** 房间内的瞬时人数 */
+    uint32_t users;
+    /** 发送字节数，累计值 */
+    uint64_t txBytes;
+    /** 接收字节数，累计值 */
+    uint64_t rxBytes;
+    /** 流的总数，可能大于传入的容量 */
+    uint32_t streamCount;
+    /** 网络连接状态(TTTConnectionState) */
+    uint32_t connectionState;
+    /** cdn推流地址数，([TTTRtcEngineKit getRtmpStatsSnapshot:capacity:])获取各推流地址的快照 */
+    uint32_t rtmpCount;
+} TTTRtcStatsSnapshot;
+
+/** cdn推流统计快照，累计值不会清零 */
+typedef struct TTTRtcRtmpStatsSnapshot {
+    /** 结构体大小，调用方设置为sizeof(TTTRtcRtmpStatsSnapshot) */
+    uint32_t structSize;
+    /** cdn推流状态，1: 推流成功 0: 未连接 */
+    uint32_t connected;
+    /** cdn推流地址，UTF-8，以'\0'结尾，超出511字节截断 */
+    char rtmpUrl[512];
+    /** 发送队列中的包数 */
+    uint32_t queueDepth;
+    /** 发送队列中数据的时长(ms) */
+    uint32_t queueDuration;
+    /** 发送的码率(kbps) */
+    uint32_t sentBitrate;
+    /** 发送字节数，累计值 */
+    uint64_t txBytes;
+    /** 因队列满丢弃的帧数，累计值 */
+    uint64_t droppedFrames;
+    /** 丢弃的完整GOP数，累计值 */
+    uint64_t droppedGops;
+} TTTRtcRtmpStatsSnapshot;
+
+/** 统计直方图，固定内存，3位有效数字精度，不可变 */
+TTT_API_UNAVAILABLE
+@interface TTTRtcHistogram : NSObject
+/** 用户id，本地用户为0，合并了不同用户或通过序列化数据创建的直方图为-1 */
+@property (assign, nonatomic, readonly) int64_t uid;
+/** 设备id，合并了不同设备或通过序列化数据创建的直方图为nil */
+@property (copy, nonatomic, readonly) NSString *deviceId;
+/** 统计项 */
+@property (assign, nonatomic, readonly) TTTRtcHistogramMetric metric;
+/** 样本数 */
+@property (assign, nonatomic, readonly) NSUInteger count;
+/** 最小值 */
+@property (assign, nonatomic, readonly) double min;
+/** 最大值 */
+@property (assign, nonatomic, readonly) double max;
+/** 平均值 */
+@property (assign, nonatomic, readonly) double mean;
+/** 50分位 */
+@property (assign, nonatomic, readonly) double p50;
+/** 95分位 */
+@property (assign, nonatomic, readonly) double p95;
+/** 99分位 */
+@property (assign, nonatomic, readonly) double p99;
+
+/**
+ *  通过序列化数据创建直方图
+ *
+ *  @param data   ([TTTRtcHistogram serializedData])的数据
+ *  @param metric 统计项，序列化数据中不包含统计项
+ *
+ *  @return 直方图，数据无效返回nil
+ */
++ (instancetype)histogramWithData:(NSData *)data metric:(TTTRtcHistogramMetric)metric;
+
+/**
+ *  获取指定分位的值
+ *
+ *  @param percentile [0.0, 100.0]
+ */
+- (double)valueAtPercentile:(double)percentile;
+
+/**
+ *  合并直方图，不修改当前直方图
+ *  uid和deviceId都相同时保留，否则合并结果的uid为-1，deviceId为nil
+ *
+ *  @param other 统计项必须相同的直方图
+ *
+ *  @return 合并后的新直方图，统计项不同返回nil
+ */
+- (TTTRtcHistogram *)histogramByMergingWith:(TTTRtcHistogram *)other;
+
+/**
+ *  序列化数据
+ *  标准HdrHistogram V2压缩格式(cookie 0x1c849304，zlib压缩)，值的单位为微秒，
+ *  服务器可使用HdrHistogram的Java, C, Go, Python等实现解码和合并
+ *  不包含uid, deviceId和统计项，上传时需要另外携带
+ */
+- (NSData *)serializedData;
+
+@end
+
 #if TARGET_OS_OSX
 /** 音频设备 */
 @interface TTTRtcAudioDevice : NSObject
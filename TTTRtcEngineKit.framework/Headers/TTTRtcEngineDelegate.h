@@ -47,6 +47,24 @@
  */
 - (void)rtcEngineReconnectServerSucceed:(TTTRtcEngineKit *)engine;
 
+/**
+ *  断网重连统计回调
+ *  重连成功([TTTRtcEngineDelegate rtcEngineReconnectServerSucceed:])之后立即触发，纯音频房间同样触发
+ *
+ *  @param stats 断网重连统计信息
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine reconnectStats:(TTTRtcReconnectStats *)stats TTT_API_UNAVAILABLE;
+
+/**
+ *  重连后远端首帧视频解码回调
+ *  重连成功后每路远端视频流解码第一帧时触发，没有远端视频时不触发
+ *
+ *  @param uid     用户ID
+ *  @param devId   设备id
+ *  @param elapsed 从网络恢复到该帧解码的延迟（毫秒）
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine firstRemoteVideoFrameDecodedAfterReconnectOfUid:(int64_t)uid deviceId:(NSString *)devId elapsed:(NSInteger)elapsed TTT_API_UNAVAILABLE;
+
 /**
  *  网络连接状态发生改变
  *  也可使用([TTTRtcEngineKit getConnectionState])获取SDK网络连接状态
@@ -158,6 +176,15 @@
  */
 - (void)rtcEngine:(TTTRtcEngineKit *)engine reportRtcStats:(TTTRtcStats *)stats;
 
+/**
+ *  订阅房间统计回调
+ *  订阅其它房间([TTTRtcEngineKit subscribeOtherChannel:])后，与([TTTRtcEngineDelegate rtcEngine:reportRtcStats:])同时回调
+ *  所有订阅房间共用一个网络连接，统计合并在一次回调中
+ *
+ *  @param stats 本房间及所有订阅房间的统计信息
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine reportChannelStats:(NSArray<TTTRtcChannelStats *> *)stats TTT_API_UNAVAILABLE;
+
 /**
  *  本地视频统计回调
  *
@@ -205,6 +232,14 @@
 - (void)rtcEngine:(TTTRtcEngineKit *)engine reportAudioLevel:(int64_t)uid
        audioLevel:(NSUInteger)audioLevel audioLevelFullRange:(NSUInteger)audioLevelFullRange;
 
+/**
+ *  接收的说话者发生变化
+ *  通过([TTTRtcEngineKit setAudioTopSpeakers:switchInterval:])启用
+ *
+ *  @param uids 当前接收音频的用户ID，按音量从大到小排列
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine activeSpeakersChanged:(NSArray<NSNumber *> *)uids TTT_API_UNAVAILABLE;
+
 /**
  *  本端音频采集数据回调
  *
@@ -338,6 +373,32 @@
 - (void)rtcEngine:(TTTRtcEngineKit *)engine  reportRtmpStatus:(BOOL)status rtmpUrl:(NSString*)rtmpUrl;
 
 
+/**
+ *  cdn推流统计回调
+ *  每个推流地址([TTTRtcEngineKit addPublishStreamUrl:])独立回调，回调间隔与统计间隔([TTTRtcEngineKit.statsInterval])相同
+ *  相同布局的推流地址共用一路编码数据，每个推流地址有独立的发送队列，单个cdn异常不会影响其它推流地址和编码
+ *
+ *  @param stats cdn推流统计信息
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine reportRtmpStats:(TTTRtcRtmpStats *)stats TTT_API_UNAVAILABLE;
+
+/**
+ *  恢复RTMP推流回调
+ *  调用([TTTRtcEngineKit resumeRtmpPublish])后，第一个关键帧发送到cdn时触发，恢复后时间戳连续
+ *
+ *  @param rtmpUrl 推流地址
+ *  @param elapsed 从调用恢复推流到第一帧发送的延迟（毫秒）
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine rtmpPublishDidResume:(NSString *)rtmpUrl elapsed:(NSInteger)elapsed TTT_API_UNAVAILABLE;
+
+/**
+ *  低延迟HLS输出状态回调
+ *
+ *  @param status    输出状态
+ *  @param outputUrl 输出地址
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine hlsPublishStatus:(TTTRtcHlsPublishStatus)status outputUrl:(NSString *)outputUrl TTT_API_UNAVAILABLE;
+
 - (void)rtcEngine:(TTTRtcEngineKit *)engine reportH264SeiContent:(NSString*)content uid:(int64_t)uid;
 
 - (void)rtcEngineOnMediaSending:(TTTRtcEngineKit *)engine;
@@ -359,6 +420,14 @@
  */
 - (void)rtcEngine:(TTTRtcEngineKit *)engine lastmileQuality:(TTTNetworkQuality)quality;
 
+/**
+ *  网络带宽探测结果回调
+ *  调用([TTTRtcEngineKit startLastmileProbeTest:])开启
+ *
+ *  @param result 网络带宽探测结果
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine lastmileProbeResult:(TTTRtcLastmileProbeResult *)result TTT_API_UNAVAILABLE;
+
 /**
  *  rtmp推流地址创建成功
  *
@@ -402,6 +471,22 @@
  */
 - (void)rtcEngine:(TTTRtcEngineKit *)engine receiveAudioLyricOfUid:(int64_t)uid lyric:(NSString *)lyric;
 
+/**
+ *  网络模拟器时间线切换回调
+ *  调用([TTTRtcEngineKit startNetworkEmulatorWithTimeline:])开启
+ *  回调之后上报的统计数据([TTTRtcEngineDelegate rtcEngine:reportRtcStats:])对应当前的网络损伤
+ *
+ *  @param step     时间线中的序号, 从0开始
+ *  @param uplink   当前生效的上行网络损伤参数, nil: 上行不损伤
+ *  @param downlink 当前生效的下行网络损伤参数, nil: 下行不损伤
+ */
+- (void)rtcEngine:(TTTRtcEngineKit *)engine networkEmulatorDidEnterStep:(NSUInteger)step uplink:(TTTRtcNetworkImpairment *)uplink downlink:(TTTRtcNetworkImpairment *)downlink TTT_API_UNAVAILABLE;
+
+/**
+ *  网络模拟器时间线执行完成
+ */
+- (void)rtcEngineNetworkEmulatorDidFinish:(TTTRtcEngineKit *)engine TTT_API_UNAVAILABLE;
+
 #pragma mark - deprecated delegate
 - (void)rtcEngine:(TTTRtcEngineKit *)engine onAnchorEnter:(int64_t)sessionID userID:(int64_t)userID error:(TTTRtcErrorCode)error __deprecated;
 - (void)rtcEngine:(TTTRtcEngineKit *)engine onAnchorExit:(int64_t)sessionID userID:(int64_t)userID __deprecated;
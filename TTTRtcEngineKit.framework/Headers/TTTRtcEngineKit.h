@@ -136,6 +136,27 @@
                     uid:(int64_t)uid
             joinSuccess:(void(^)(NSString *channel, int64_t uid, NSInteger elapsed))joinSuccessBlock;
 
+/**
+ *  设置服务器地址缓存有效期
+ *  加入房间时并行连接候选服务器，使用最先完成连接和鉴权的服务器，并按appID和地区缓存
+ *  有效期内再次加入房间([TTTRtcEngineKit joinChannelByKey:channelName:uid:joinSuccess:])优先使用缓存的服务器
+ *  缓存在进程内共用，不依赖引擎实例，可在([TTTRtcEngineKit sharedEngineWithAppId:delegate:])之前调用，
+ *  ([TTTRtcEngineKit getAkamai:channel:completionHandler:])共用该缓存
+ *
+ *  @param seconds 有效期(秒)，默认600, 0: 不缓存
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
++ (int)setServerCacheTimeout:(NSUInteger)seconds TTT_API_UNAVAILABLE;
+
+/**
+ *  清除缓存的服务器地址
+ *  设置服务器地址([TTTRtcEngineKit setServerIp:port:])后会自动清除
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
++ (int)clearServerCache TTT_API_UNAVAILABLE;
+
 /**
  *  离开通话频道
  *
@@ -597,11 +618,115 @@
  */
 - (int)enableAudioVolumeIndication:(NSInteger)interval smooth:(NSInteger)smooth;
 
+/**
+ *  只接收音量最大的K路音频
+ *  直播模式(TTTRtc_ChannelProfile_LiveBroadcasting)下有效，根据音频包头中的音量信息选择，只接收和解码选中的音频流，
+ *  下行带宽和解码开销不随房间内副播人数增加
+ *  为避免频繁切换，新的说话者需要在switchInterval内持续比当前最小音量的说话者更响才会被选中
+ *  选中的说话者发生变化([TTTRtcEngineDelegate rtcEngine:activeSpeakersChanged:])
+ *
+ *  @param count          接收的音频流数，0: 接收所有音频流(默认)
+ *  @param switchInterval 切换间隔(ms)，建议设置大于500
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setAudioTopSpeakers:(NSUInteger)count switchInterval:(NSUInteger)switchInterval TTT_API_UNAVAILABLE;
+
+/**
+ *  启用/禁用视频帧延迟追踪
+ *  按视频帧ID([TTTRtcVideoFrame.frameID])记录采集、前处理、编码、打包、发送、接收、解码、渲染各阶段的时间，
+ *  发送端的时间通过RTP扩展头传给接收端，远端用户也需要启用
+ *  跨设备的阶段(TTTRtc_FrameStage_Network, TTTRtc_FrameStage_Total)由接收端估计双方的时钟偏差：
+ *  偏差 = (发送端时间 + rtt/2) - 接收端时间，取rtt最小的若干次样本，发送端时间减去偏差后计算，
+ *  误差不超过最小rtt的一半，时钟偏差尚未估计出来之前不统计这两个阶段
+ *
+ *  @param enable YES: 启用，NO: 禁用(默认)
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)enableFrameLatencyTracing:(BOOL)enable TTT_API_UNAVAILABLE;
+
+/**
+ *  获取视频帧各阶段延迟统计
+ *  统计从启用追踪或上次重置开始
+ *
+ *  @param uid   用户ID，本地用户为0
+ *  @param devId 设备id(远端用户多设备), 默认设置nil
+ *  @param reset YES: 获取后重新统计
+ *
+ *  @return 各阶段延迟统计
+ */
+- (NSArray<TTTRtcFrameLatencyStats *> *)getFrameLatencyStats:(int64_t)uid deviceId:(NSString *)devId reset:(BOOL)reset TTT_API_UNAVAILABLE;
+
+/**
+ *  获取统计快照
+ *  不经过代理回调，不分配内存，所有流的数据来自同一时刻，可在任意线程高频调用(如100ms)
+ *  streams容量不足时只填充前capacity路，通过([TTTRtcStatsSnapshot.streamCount])获取实际流数
+ *  调用前设置snapshot和streams[0]的structSize，streams按streams[0].structSize为步长填充，SDK只写入structSize以内的字段，
+ *  structSize小于SDK支持的最小值时返回<0
+ *
+ *  @param snapshot 通话统计快照，由调用方分配
+ *  @param streams  单路流统计快照数组，由调用方分配，可为NULL
+ *  @param capacity streams数组的容量
+ *
+ *  @return >=0: 填充的流数，<0: 方法调用失败。
+ */
+- (int)getStatsSnapshot:(TTTRtcStatsSnapshot *)snapshot streams:(TTTRtcStreamStatsSnapshot *)streams capacity:(NSUInteger)capacity TTT_API_UNAVAILABLE;
+
+/**
+ *  获取cdn推流统计快照
+ *  与([TTTRtcEngineKit getStatsSnapshot:streams:capacity:])相同，不分配内存，按streams[0].structSize为步长填充
+ *
+ *  @param streams  cdn推流统计快照数组，由调用方分配
+ *  @param capacity streams数组的容量
+ *
+ *  @return >=0: 填充的推流地址数，<0: 方法调用失败。
+ */
+- (int)getRtmpStatsSnapshot:(TTTRtcRtmpStatsSnapshot *)streams capacity:(NSUInteger)capacity TTT_API_UNAVAILABLE;
+
+/**
+ *  获取统计直方图
+ *  统计从加入房间或上次重置开始，不受统计间隔([TTTRtcEngineKit.statsInterval])影响
+ *
+ *  @param uid   用户ID，本地用户为0
+ *  @param devId 设备id(远端用户多设备), 默认设置nil
+ *  @param reset YES: 获取后重新统计
+ *
+ *  @return 各统计项的直方图
+ */
+- (NSArray<TTTRtcHistogram *> *)getStatsHistograms:(int64_t)uid deviceId:(NSString *)devId reset:(BOOL)reset TTT_API_UNAVAILABLE;
+
+#if TARGET_OS_OSX
+
+/**
+ *  开启统计数据导出(OpenMetrics)
+ *  在本地启动HTTP服务，通过"http://address:port/metrics"获取OpenMetrics格式的统计数据，可用Prometheus采集
+ *  包含通话、本地和远端音视频、网络连接状态和cdn推流的统计，
+ *  由([TTTRtcEngineKit getStatsSnapshot:streams:capacity:])和([TTTRtcEngineKit getRtmpStatsSnapshot:capacity:])的快照生成，不阻塞音视频线程
+ *
+ *  @param address 监听地址，nil: 127.0.0.1
+ *  @param port    监听端口
+ *  @param maxUids 按uid区分的远端用户数上限，超出部分合并为uid="other"
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startMetricsExporter:(NSString *)address port:(int)port maxUids:(NSUInteger)maxUids TTT_API_UNAVAILABLE;
+
+/**
+ *  关闭统计数据导出
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopMetricsExporter TTT_API_UNAVAILABLE;
+
+#endif
+
 /**
  *  设置日志文件
  *  正式发版或上线不建议设置该路径，有需求的用户需要管理日志文件
+ *  2.10.0起可使用二进制格式([TTTRtcEngineKit setLogFormat:])降低日志开销
  *
- *  @param filePath 日志文件的完整路径。该日志文件为UTF-8编码。
+ *  @param filePath 日志文件的完整路径。该日志文件为UTF-8编码，2.10.0起二进制格式(TTTRtc_LogFormat_Binary)除外。
  *
  *  @return 0: 方法调用成功，<0: 方法调用失败。
  */
@@ -616,6 +741,52 @@
  */
 - (int)setLogFilter:(TTTRtcLogFilter)filter;
 
+/**
+ *  设置日志文件格式
+ *  在设置日志文件([TTTRtcEngineKit setLogFile:])之前调用
+ *  所有日志先写入各线程的无锁缓冲区，由后台线程写入文件，二进制格式不在SDK内格式化字符串
+ *
+ *  @param format 日志文件格式
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setLogFormat:(TTTRtcLogFormat)format TTT_API_UNAVAILABLE;
+
+/**
+ *  设置日志文件轮转
+ *  默认不轮转，不会删除([TTTRtcEngineKit setLogFile:])的日志文件，调用该方法后开启。日志文件超过大小或时间后重命名为xxx.1, xxx.2...并创建新文件，超过总大小时删除最早的文件
+ *  压缩(gzip)在后台线程进行，不影响写日志
+ *
+ *  @param fileSize       单个日志文件大小上限(Byte)，建议10MB，0: 关闭轮转
+ *  @param totalSize      所有日志文件总大小上限(Byte)，建议100MB，0: 不限制
+ *  @param rotateInterval 轮转间隔(s)，0: 只按大小轮转
+ *  @param compress       YES: 压缩轮转后的日志文件(xxx.1.gz)，NO: 不压缩
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setLogFileMaxSize:(NSUInteger)fileSize maxTotalSize:(NSUInteger)totalSize rotateInterval:(NSUInteger)rotateInterval compress:(BOOL)compress TTT_API_UNAVAILABLE;
+
+/**
+ *  获取日志文件
+ *  用于上传日志，返回前会将缓冲区中的日志写入文件
+ *
+ *  @return 日志文件完整路径数组，当前日志文件在最后
+ */
+- (NSArray<NSString *> *)getLogFiles TTT_API_UNAVAILABLE;
+
+/**
+ *  二进制日志转换为文本
+ *  不需要初始化SDK，也可在其它设备上转换上传的日志
+ *  二进制日志只记录格式id，文件头中记录了写入日志的SDK版本([TTTRtcEngineKit getSdkVersion])，
+ *  需要使用相同版本的SDK转换，版本不同返回<0
+ *
+ *  @param binaryPath 二进制日志文件路径
+ *  @param textPath   输出的文本日志文件路径
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
++ (int)decodeLogFile:(NSString *)binaryPath toFile:(NSString *)textPath TTT_API_UNAVAILABLE;
+
 /**
  *  往日志文件中增加自定义日志
  *  进入房间后才可使用
@@ -636,6 +807,18 @@
  */
 - (int)setSignalTimeout:(NSUInteger)seconds;
 
+/**
+ *  启用/禁用会话恢复(快速重连)
+ *  加入房间前设置，默认启用
+ *  网络恢复后使用会话令牌恢复房间状态，只重新订阅发生变化的视频流并立即请求关键帧，断网期间音频继续播放缓存数据
+ *  重连统计回调([TTTRtcEngineDelegate rtcEngine:reconnectStats:])
+ *
+ *  @param enable YES: 启用会话恢复，NO: 重连时重新加入房间
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)enableSessionResumption:(BOOL)enable TTT_API_UNAVAILABLE;
+
 /**
  *  设置音频编码选项
  *
@@ -933,6 +1116,33 @@
  */
 - (int)setRemoteDefaultVideoStreamType:(TTTRtcVideoStreamType)streamType;
 
+/**
+ *  设置视频多层编码(simulcast)
+ *  加入房间前设置，与([TTTRtcEngineKit enableDualStreamMode:])互斥
+ *  每个空间层的宽高为上一层的一半，每个空间层划分temporalLayers个时间层(编号0~temporalLayers-1，0为最低帧率)，服务器可直接丢弃高时间层的帧而不需要重新编码
+ *  分层统计信息([TTTRtcLocalVideoStats.layerStats])
+ *
+ *  @param spatialLayers  空间层数，取值[1,3]，1: 关闭多层编码
+ *  @param temporalLayers 时间层数，取值[1,3]
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)enableSimulcast:(NSUInteger)spatialLayers temporalLayers:(NSUInteger)temporalLayers TTT_API_UNAVAILABLE;
+
+/**
+ *  设置接收远端视频的层
+ *  如果远端用户启用了多层编码([TTTRtcEngineKit enableSimulcast:temporalLayers:]), 该方法指定接收的空间层和时间层
+ *  超出远端用户实际层数时，接收最接近的层
+ *
+ *  @param uid           用户ID
+ *  @param spatialLayer  空间层，取值[0, spatialLayers-1]，0为最低分辨率
+ *  @param temporalLayer 时间层，取值[0, temporalLayers-1]，0为最低帧率
+ *  @param devId         设备id(远端用户多设备), 默认设置nil
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setRemoteVideoStream:(int64_t)uid spatialLayer:(NSUInteger)spatialLayer temporalLayer:(NSUInteger)temporalLayer deviceId:(NSString *)devId TTT_API_UNAVAILABLE;
+
 /**
  *  设置混屏背景图片
  *  在加入房间之前调用rtmpUrl设置为nil。
@@ -943,6 +1153,23 @@
  */
 - (void)setVideoMixerBackgroundImgUrl:(NSString *)url forRtmpUrl:(NSString *)rtmpUrl;
 
+/**
+ *  设置混屏背景图缓存上限
+ *  背景图([TTTRtcEngineKit setVideoMixerBackgroundImgUrl:forRtmpUrl:])在后台下载和解码，按地址和画布尺寸缓存，
+ *  布局改变和增加推流地址不会重新解码，下载完成前使用背景颜色
+ *  超出上限时淘汰最久未使用的图片
+ *
+ *  @param bytes 缓存上限(Byte)，默认32MB
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setVideoMixerBackgroundImageCacheLimit:(NSUInteger)bytes TTT_API_UNAVAILABLE;
+
+/**
+ *  获取混屏背景图缓存统计信息
+ */
+- (TTTRtcImageCacheStats *)getVideoMixerBackgroundImageCacheStats TTT_API_UNAVAILABLE;
+
 /**
  *  开启网络质量检测
  *  对应回调([TTTRtcEngineDelegate rtcEngine:lastmileQuality:])
@@ -958,6 +1185,24 @@
  */
 - (int)disableLastmileTest;
 
+/**
+ *  开始网络带宽探测
+ *  在加入房间之前调用，通过发送包组和码率递增的探测包估计上下行带宽、抖动、丢包和rtt
+ *  探测结果([TTTRtcEngineDelegate rtcEngine:lastmileProbeResult:])，探测码率不超过配置的期望码率
+ *
+ *  @param config 网络带宽探测配置
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startLastmileProbeTest:(TTTRtcLastmileProbeConfig *)config TTT_API_UNAVAILABLE;
+
+/**
+ *  停止网络带宽探测
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopLastmileProbeTest TTT_API_UNAVAILABLE;
+
 /**
  *  订阅其它房间主播视频(PK)
  *  订阅成功([TTTRtcEngineDelegate rtcEngine:didJoinedOfUid:clientRole:isVideoEnabled:elapsed:]), 其它房间主播以副播身份加入本房间
@@ -978,6 +1223,14 @@
  */
 - (int)unSubscribeOtherChannel:(int64_t)channelId;
 
+/**
+ *  获取已订阅的其它房间
+ *  2.10.0起可多次调用([TTTRtcEngineKit subscribeOtherChannel:])订阅多个房间(最多32个)，所有订阅共用一个网络连接和解码器，不需要创建多个引擎
+ *
+ *  @return 房间id数组
+ */
+- (NSArray<NSNumber *> *)getSubscribedChannels TTT_API_UNAVAILABLE;
+
 /**
  *  更新rtmp推流地址
  *  收到([TTTRtcEngineDelegate rtcEngine:reportRtmpStatus:rtmpUrl:])失败，可以更新一个新的推流地址
@@ -1006,6 +1259,48 @@
  */
 - (int)stopAudioRecording;
 
+/**
+ *  开始录制本地或远端音视频流
+ *  以fragmented MP4格式分片写入，在后台线程写文件，异常退出最多丢失最后一个分片，已写入的分片仍可播放
+ *
+ *  @param config  本地录制配置
+ *  @param handler 录制出错或结束的回调, error为nil表示正常结束
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startMediaRecording:(TTTRtcMediaRecordConfiguration *)config handler:(void(^)(NSError *error))handler TTT_API_UNAVAILABLE;
+
+/**
+ *  停止录制音视频流
+ *
+ *  @param uid   用户id，本地用户为0
+ *  @param devId 设备id(远端用户多设备), 默认设置nil
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopMediaRecording:(int64_t)uid deviceId:(NSString *)devId TTT_API_UNAVAILABLE;
+
+/**
+ *  开始录制混屏输出
+ *  录制内容与cdn推流相同(画中画布局([TTTRtcVideoCompositingLayout])和混音)，直接使用推流的编码数据，不会重新编码
+ *  在加入房间成功并开始推流后调用，忽略([TTTRtcMediaRecordConfiguration.uid])
+ *
+ *  @param config  本地录制配置
+ *  @param handler 录制出错或结束的回调, error为nil表示正常结束
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startVideoMixerRecording:(TTTRtcMediaRecordConfiguration *)config handler:(void(^)(NSError *error))handler TTT_API_UNAVAILABLE;
+
+/**
+ *  停止录制混屏输出
+ *
+ *  @param rtmpUrl cdn推流地址, 推单路流可设置为nil
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopVideoMixerRecording:(NSString *)rtmpUrl TTT_API_UNAVAILABLE;
+
 /**
  *  配置外部音频源
  *  在加入房间之前开启, 开启该功能需要同时做采集和播放。
@@ -1110,6 +1405,26 @@
  */
 - (int)removePublishStreamUrl:(NSString *)url;
 
+/**
+ *  开始低延迟HLS(fMP4部分分片)输出
+ *  在加入房间成功后设置，直接封装已编码的混屏数据，不会重新编码，可与cdn推流同时使用
+ *  输出状态([TTTRtcEngineDelegate rtcEngine:hlsPublishStatus:outputUrl:])
+ *
+ *  @param config 低延迟HLS输出配置
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startHlsPublish:(TTTRtcHlsConfiguration *)config TTT_API_UNAVAILABLE;
+
+/**
+ *  停止低延迟HLS输出
+ *
+ *  @param outputUrl 输出地址
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopHlsPublish:(NSString *)outputUrl TTT_API_UNAVAILABLE;
+
 /**
  *  获取Akamai的拉流地址
  *
@@ -1121,6 +1436,40 @@
  */
 + (int)getAkamai:(NSString *)appID channel:(NSString *)channelId completionHandler:(void(^)(NSError *error, NSString *serverid))handler;
 
+/**
+ *  设置网络模拟器的网络损伤
+ *  模拟器位于传输层和socket之间，仅作用于本进程，不需要root权限
+ *  用于测试，正式发版或上线不要调用该接口
+ *
+ *  上行和下行分别设置，可模拟不对称的网络
+ *
+ *  @param uplink   上行网络损伤参数, nil: 上行不损伤
+ *  @param downlink 下行网络损伤参数, nil: 下行不损伤，两者都为nil时关闭网络模拟器
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)setNetworkImpairment:(TTTRtcNetworkImpairment *)uplink downlink:(TTTRtcNetworkImpairment *)downlink TTT_API_UNAVAILABLE;
+
+/**
+ *  按时间线文件运行网络模拟器
+ *  时间线文件为JSON数组，每一项包含"duration"(ms)及可选的"uplink", "downlink"对象，对象字段与([TTTRtcNetworkImpairment])同名，
+ *  e.g. [{"duration":10000,"uplink":{"lossRate":0.05,"lossBurstLength":4}},{"duration":5000,"uplink":{"bandwidth":300},"downlink":{"delay":200,"jitter":50}}]
+ *  切换回调([TTTRtcEngineDelegate rtcEngine:networkEmulatorDidEnterStep:uplink:downlink:])
+ *  完成回调([TTTRtcEngineDelegate rtcEngineNetworkEmulatorDidFinish:])
+ *
+ *  @param filePath 时间线文件的完整路径
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)startNetworkEmulatorWithTimeline:(NSString *)filePath TTT_API_UNAVAILABLE;
+
+/**
+ *  停止网络模拟器
+ *
+ *  @return 0: 方法调用成功，<0: 方法调用失败。
+ */
+- (int)stopNetworkEmulator TTT_API_UNAVAILABLE;
+
 #pragma mark - deprecated API
 - (void)setVideoMixerParams:(CGSize)videoSize videoFrameRate:(NSUInteger)videoFrameRate videoBitRate:(NSUInteger)videoBitRate DEPRECATED_MSG_ATTRIBUTE("see TTTPublisherConfiguration");
 - (void)setAudioMixerParams:(NSUInteger)samplerate channels:(NSUInteger)channels DEPRECATED_MSG_ATTRIBUTE("see TTTPublisherConfiguration");